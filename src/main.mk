@@ -49,6 +49,7 @@ SOURCES      := AS_global.C \
                 utility/kmers-writer-stream.C \
                 utility/kmers-statistics.C \
                 utility/kmers-exact.C \
+                utility/kmers-exact-multi.C \
                 \
                 utility/bits.C \
                 \
@@ -155,6 +156,7 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 stores/sqStoreCreate.mk \
                 stores/sqStoreDumpFASTQ.mk \
                 stores/sqStoreDumpMetaData.mk \
+                stores/sqStoreRelayout.mk \
                 stores/tgStoreCompress.mk \
                 stores/tgStoreDump.mk \
                 stores/tgStoreLoad.mk \
@@ -217,5 +219,8 @@ SUBMAKEFILES += utility/bitsTest.mk \
                 utility/filesTest.mk \
                 utility/intervalListTest.mk \
                 utility/loggingTest.mk \
-                utility/stddevTest.mk
+                utility/stddevTest.mk \
+                utility/sweatShopTest.mk \
+                stores/tgTigTest.mk \
+                stores/sqCacheTest.mk
 endif